@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <type_traits>
 
 /**
   State variable filter (SVF), designed by Andrew Simper of Cytomic.
@@ -11,6 +12,20 @@ template <typename T, int NumChannels>
 class StateVariableFilter
 {
 public:
+    /**
+      Plain copy of the coefficients and internal state. Saving and restoring
+      is just a memberwise copy, so it's safe to do on the audio thread.
+     */
+    struct Snapshot
+    {
+        T g, k, a1, a2, a3;
+        T m0, m1, m2;
+        T ic1eq[NumChannels];
+        T ic2eq[NumChannels];
+    };
+
+    static_assert(std::is_trivially_copyable_v<Snapshot>);
+
     StateVariableFilter() : m0(0.0), m1(0.0), m2(0.0) { }
 
     void lowShelf(T sampleRate, T freq, T Q, T dbGain) noexcept
@@ -47,6 +62,38 @@ public:
         }
     }
 
+    void saveState(Snapshot& snapshot) const noexcept
+    {
+        snapshot.g = g;
+        snapshot.k = k;
+        snapshot.a1 = a1;
+        snapshot.a2 = a2;
+        snapshot.a3 = a3;
+        snapshot.m0 = m0;
+        snapshot.m1 = m1;
+        snapshot.m2 = m2;
+        for (int channel = 0; channel < NumChannels; ++channel) {
+            snapshot.ic1eq[channel] = ic1eq[channel];
+            snapshot.ic2eq[channel] = ic2eq[channel];
+        }
+    }
+
+    void restoreState(const Snapshot& snapshot) noexcept
+    {
+        g = snapshot.g;
+        k = snapshot.k;
+        a1 = snapshot.a1;
+        a2 = snapshot.a2;
+        a3 = snapshot.a3;
+        m0 = snapshot.m0;
+        m1 = snapshot.m1;
+        m2 = snapshot.m2;
+        for (int channel = 0; channel < NumChannels; ++channel) {
+            ic1eq[channel] = snapshot.ic1eq[channel];
+            ic2eq[channel] = snapshot.ic2eq[channel];
+        }
+    }
+
     T processSample(int channel, T v0) noexcept
     {
         T v3 = v0 - ic2eq[channel];
@@ -1,11 +1,35 @@
 #pragma once
 
+#include <type_traits>
 #include "StateVariableFilter.h"
 
 template <typename SampleType, int NumChannels>
 class ThreeBandEQ
 {
+    using Filter = StateVariableFilter<SampleType, NumChannels>;
+
 public:
+    /**
+      Complete state of the EQ: sample rate, current gains, and the filter
+      coefficients and delay lines. Restoring a snapshot puts the EQ back
+      exactly where it was without recomputing any coefficients, e.g. to
+      swap in a pre-warmed voice or to resume an offline render.
+     */
+    struct Snapshot
+    {
+        SampleType sampleRate;
+        SampleType bass;
+        SampleType mids;
+        SampleType treble;
+
+        typename Filter::Snapshot bassFilter;
+        typename Filter::Snapshot midsFilter1;
+        typename Filter::Snapshot midsFilter2;
+        typename Filter::Snapshot trebleFilter;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Snapshot>);
+
     void prepare(SampleType newSampleRate)
     {
         sampleRate = newSampleRate;
@@ -48,6 +72,44 @@ public:
         }
     }
 
+    void saveState(Snapshot& snapshot) const noexcept
+    {
+        snapshot.sampleRate = sampleRate;
+        snapshot.bass = bass;
+        snapshot.mids = mids;
+        snapshot.treble = treble;
+
+        bassFilter.saveState(snapshot.bassFilter);
+        midsFilter1.saveState(snapshot.midsFilter1);
+        midsFilter2.saveState(snapshot.midsFilter2);
+        trebleFilter.saveState(snapshot.trebleFilter);
+    }
+
+    void restoreState(const Snapshot& snapshot) noexcept
+    {
+        sampleRate = snapshot.sampleRate;
+        bass = snapshot.bass;
+        mids = snapshot.mids;
+        treble = snapshot.treble;
+
+        bassFilter.restoreState(snapshot.bassFilter);
+        midsFilter1.restoreState(snapshot.midsFilter1);
+        midsFilter2.restoreState(snapshot.midsFilter2);
+        trebleFilter.restoreState(snapshot.trebleFilter);
+    }
+
+    /**
+      Exchanges the EQ's current state with the snapshot. Afterwards, the
+      snapshot holds what the EQ was doing before the call.
+     */
+    void swapState(Snapshot& snapshot) noexcept
+    {
+        Snapshot previous;
+        saveState(previous);
+        restoreState(snapshot);
+        snapshot = previous;
+    }
+
     SampleType processSample(int channel, SampleType sample) noexcept
     {
         sample = bassFilter.processSample(channel, sample);
@@ -67,8 +129,8 @@ private:
     SampleType mids;
     SampleType treble;
 
-    StateVariableFilter<SampleType, NumChannels> bassFilter;
-    StateVariableFilter<SampleType, NumChannels> midsFilter1;
-    StateVariableFilter<SampleType, NumChannels> midsFilter2;
-    StateVariableFilter<SampleType, NumChannels> trebleFilter;
+    Filter bassFilter;
+    Filter midsFilter1;
+    Filter midsFilter2;
+    Filter trebleFilter;
 };